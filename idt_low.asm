@@ -252,6 +252,7 @@ isr_common_stub:
     push es
     push fs
     push gs
+    cld            ; C code expects DF clear; IRET restores the old value
    
     mov eax, esp   ; Push us the stack
     push eax
@@ -120,6 +120,10 @@ irq_common_stub:
     push fs
     push gs
 
+    ; The interrupted code may have the direction flag set (memmove copies
+    ; backwards). C code expects it clear; IRET restores the old value.
+    cld
+
     mov eax, esp
 
     push eax